@@ -265,6 +265,24 @@ function bench_nitg-e_gc()
 }
 bench_nitg-e_gc
 
+function bench_nitg-s_gc()
+{
+	name="$FUNCNAME"
+	skip_test "$name" && return
+	run_command ./nitg --separate ../tests/bench_bintree_gen.nit -o "bintrees.bin"
+	run_command ./nitg --separate ../tests/shootout_binarytrees.nit -o "binarytrees.bin"
+	for gc in boehm incremental large malloc; do
+		prepare_res "$name-$gc.dat" "$gc" "nitg with --separate and NIT_GC_OPTION=$gc"
+		export NIT_GC_OPTION="$gc"
+		bench_command "bintrees" "bench_bintree_gen 17" "./bintrees.bin" 17
+		bench_command "binarytrees" "shootout_binarytrees 16" "./binarytrees.bin" 16
+	done
+	unset NIT_GC_OPTION
+	plot "$name.gnu"
+	rm -r *.bin .nit_compile
+}
+bench_nitg-s_gc
+
 function bench_cc_nitg-e()
 {
 	name="$FUNCNAME"
@@ -0,0 +1,76 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Benches the throughput of a nitcorn server
+#
+# Requests a short page with and without persistent connections,
+# then static files served by a `FileServer`.
+
+source ./bench_common.sh
+source ./bench_plot.sh
+
+# Default number of times a command must be run with bench_command
+# Can be overrided with 'the option -n'
+count=2
+
+function usage()
+{
+	echo "run_bench: [options]* [nb_requests]"
+	echo "  -v: verbose mode"
+	echo "  -n count: number of execution for each bar (default: $count)"
+	echo "  -p port: port of the server (default: 8089)"
+	echo "  -h: this help"
+}
+
+port=8089
+
+stop=false
+while [ "$stop" = false ]; do
+	case "$1" in
+		-v) verbose=true; shift;;
+		-h) usage; exit;;
+		-n) count="$2"; shift; shift;;
+		-p) port="$2"; shift; shift;;
+		*) stop=true
+	esac
+done
+
+total=${1:-20000}
+
+../bin/nitg ./nitcorn/hello_server.nit -o hello_server.bin || exit 1
+../bin/nitg ./nitcorn/http_client.nit -o http_client.bin || exit 1
+
+mkdir -p www
+head -c 100000 /dev/urandom > www/small.bin
+head -c 10000000 /dev/urandom > www/large.bin
+
+./hello_server.bin "$port" www &
+server=$!
+sleep 1
+
+prepare_res "nitcorn.dat" "nitcorn" "nitcorn"
+for mode in close keep-alive; do
+	bench_command "$mode" "$total requests, connection $mode" ./http_client.bin localhost "$port" "$total" "$mode"
+done
+plot nitcorn.gnu
+
+prepare_res "nitcorn_files.dat" "files" "nitcorn files"
+bench_command "100KB" "$((total / 10)) requests of a 100KB file" ./http_client.bin localhost "$port" "$((total / 10))" keep-alive /files/small.bin
+bench_command "10MB" "$((total / 1000)) requests of a 10MB file" ./http_client.bin localhost "$port" "$((total / 1000))" keep-alive /files/large.bin
+plot nitcorn_files.gnu
+
+kill $server
+
+rm -r hello_server.bin http_client.bin www .nit_compile
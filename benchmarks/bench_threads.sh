@@ -0,0 +1,56 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Benches the scalability of allocations in multi-threaded programs
+
+source ./bench_common.sh
+source ./bench_plot.sh
+
+# Default number of times a command must be run with bench_command
+# Can be overrided with 'the option -n'
+count=2
+
+function usage()
+{
+	echo "run_bench: [options]* [total_nodes]"
+	echo "  -v: verbose mode"
+	echo "  -n count: number of execution for each bar (default: $count)"
+	echo "  -h: this help"
+}
+
+stop=false
+while [ "$stop" = false ]; do
+	case "$1" in
+		-v) verbose=true; shift;;
+		-h) usage; exit;;
+		-n) count="$2"; shift; shift;;
+		*) stop=true
+	esac
+done
+
+total=${1:-100000000}
+
+../bin/nitg ./threads/alloc_threads.nit -o alloc_threads.bin || exit 1
+
+for gc in large boehm malloc; do
+	prepare_res "alloc_threads-$gc.dat" "$gc" "NIT_GC_OPTION=$gc"
+	for t in 1 2 4 8 16; do
+		NIT_GC_OPTION="$gc" bench_command "$t" "$t threads, $total nodes" ./alloc_threads.bin "$t" "$total"
+	done
+done
+
+plot alloc_threads.gnu
+
+rm -r alloc_threads.bin .nit_compile
@@ -22,7 +22,7 @@
 	#define PRINT_ERROR(...) ((void)fprintf(stderr, __VA_ARGS__))
 #endif
 
-enum gc_option { gc_opt_large, gc_opt_malloc, gc_opt_boehm } gc_option;
+enum gc_option { gc_opt_large, gc_opt_malloc, gc_opt_boehm, gc_opt_incremental } gc_option;
 
 #ifdef WITH_LIBGC
 #include <gc/gc.h>
@@ -33,33 +33,72 @@ void *nit_raw_alloc(size_t s0)
 	switch (gc_option) {
 	case gc_opt_malloc: return malloc(s0);
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: return GC_MALLOC_ATOMIC(s0);
+	case gc_opt_boehm:
+	case gc_opt_incremental: return GC_MALLOC_ATOMIC(s0);
 #endif
 
 	default: return nit_alloc(s0);
 	}
 }
 
+/* Size of the thread-local allocation buffers of the `large` option. */
+#define LARGE_TLAB_SIZE (1024*1024)
+
+/* Size of the slabs of the shared pool where the buffers are carved from. */
+#define LARGE_POOL_SIZE (16*LARGE_TLAB_SIZE)
+
+/* Shared pool of memory for the thread-local allocation buffers.
+ * It is protected by `large_pool_lock`, a spin lock only taken when a
+ * thread needs a new buffer. */
+static char *large_pool_pos = NULL;
+static size_t large_pool_size = 0;
+static volatile int large_pool_lock = 0;
+
+/* Thread-local allocation buffer.
+ * Each thread bump-allocates in its own buffer, without synchronization. */
+static __thread char *large_tlab_pos = NULL;
+static __thread size_t large_tlab_size = 0;
+
+/* Get `s` bytes of zeroed memory from the shared pool. */
+static char *large_pool_alloc(size_t s)
+{
+	char *res;
+
+	/* Big requests get their own area. */
+	if (s > LARGE_TLAB_SIZE) return (char *)calloc(s, 1);
+
+	while (__sync_lock_test_and_set(&large_pool_lock, 1)) { /* spin */ }
+	if (large_pool_size < s) {
+		large_pool_size = LARGE_POOL_SIZE;
+		large_pool_pos = (char *)calloc(large_pool_size, 1);
+	}
+	res = large_pool_pos;
+	large_pool_pos += s;
+	large_pool_size -= s;
+	__sync_lock_release(&large_pool_lock);
+	return res;
+}
+
 static void *large_alloc(size_t s0)
 {
-	static char * alloc_pos = NULL;
-	static size_t alloc_size = 0;
 	void * res;
-	size_t s = ((s0+3)/4)*4;
-	if(alloc_size < s) {
-		alloc_size = s + 1024*1024;
-		alloc_pos = (char *)calloc(alloc_size, 1);
+	size_t s = ((s0+sizeof(void*)-1)/sizeof(void*))*sizeof(void*);
+	if (large_tlab_size < s) {
+		if (s > LARGE_TLAB_SIZE) return large_pool_alloc(s);
+		large_tlab_pos = large_pool_alloc(LARGE_TLAB_SIZE);
+		large_tlab_size = LARGE_TLAB_SIZE;
 	}
-	res = alloc_pos;
-	alloc_size -= s;
-	alloc_pos += s;
+	res = large_tlab_pos;
+	large_tlab_size -= s;
+	large_tlab_pos += s;
 	return res;
 }
 
 void nit_gcollect(void) {
 	switch (gc_option) {
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: GC_gcollect(); break;
+	case gc_opt_boehm:
+	case gc_opt_incremental: GC_gcollect(); break;
 #endif
 	}
 }
@@ -68,7 +107,8 @@ void *nit_alloc(size_t s0)
 {
 	switch (gc_option) {
 #ifdef WITH_LIBGC
-	case gc_opt_boehm: return GC_MALLOC(s0);
+	case gc_opt_boehm:
+	case gc_opt_incremental: return GC_MALLOC(s0);
 #endif
 	case gc_opt_malloc: return calloc(1, s0);
 	case gc_opt_large:
@@ -95,6 +135,12 @@ void initialize_gc_option(void) {
 			gc_option = gc_opt_boehm;
 #else
 		PRINT_ERROR( "Compiled without Boehm GC support. Using default '%s'.\n", def);
+#endif
+		} else if (strcmp(opt, "incremental")==0) {
+#ifdef WITH_LIBGC
+			gc_option = gc_opt_incremental;
+#else
+		PRINT_ERROR( "Compiled without Boehm GC support. Using default '%s'.\n", def);
 #endif
 		} else if (strcmp(opt, "malloc")==0) {
 			gc_option = gc_opt_malloc;
@@ -103,7 +149,7 @@ void initialize_gc_option(void) {
 		} else if (strcmp(opt, "help")==0) {
 			PRINT_ERROR( "NIT_GC_OPTION accepts 'malloc', 'large'"
 #ifdef WITH_LIBGC
-					", 'boehm'"
+					", 'boehm', 'incremental'"
 #endif
 					". Default is '%s'.\n", def);
 			exit(1);
@@ -116,6 +162,13 @@ void initialize_gc_option(void) {
 	switch(gc_option) {
 #ifdef WITH_LIBGC
 		case gc_opt_boehm: GC_INIT(); break;
+		case gc_opt_incremental:
+			/* Incremental mode: the marking is done in small steps
+			 * between allocations, the pages written meanwhile are
+			 * found with virtual dirty bits and marked again. */
+			GC_INIT();
+			GC_enable_incremental();
+			break;
 #endif
 		default: break; /* Nothing */
 	}
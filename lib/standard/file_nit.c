@@ -52,6 +52,16 @@ void *file_NativeFile_NativeFile_file_stat_0(FILE *f){
 	return 0;
 }
 
+long file_NativeFile_NativeFile_io_remaining_0(FILE *f){
+	struct stat st;
+	long pos;
+	if (fstat(fileno(f), &st) != 0 || !S_ISREG(st.st_mode)) return -1;
+	pos = ftell(f);
+	if (pos < 0) return -1;
+	if (pos > st.st_size) return 0;
+	return st.st_size - pos;
+}
+
 extern int string_NativeString_NativeString_file_delete_0(char *f){
   return (remove(f) == 0);
 }
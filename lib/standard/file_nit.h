@@ -28,6 +28,8 @@ extern int string_NativeString_NativeString_file_delete_0(char *f);
 #define file_NativeFile_NativeFile_io_read_2(p, b, l) fread((b), 1, (l), (FILE*)(p))
 #define file_NativeFile_NativeFile_io_write_2(p, b, l) fwrite((b), 1, (l), (FILE*)(p))
 #define file_NativeFile_NativeFile_io_close_0(self) fclose((FILE*)(self))
+#define file_NativeFile_NativeFile_io_read_to_3(p, b, f, l) fread((b) + (f), 1, (l), (FILE*)(p))
+extern long file_NativeFile_NativeFile_io_remaining_0(FILE *f);
 
 #define file_NativeFileCapable_NativeFileCapable_io_open_read_1(p0) fopen((p0), "r")
 
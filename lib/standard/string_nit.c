@@ -9,6 +9,7 @@
  * another product.
  */
 
+#include <string.h>
 #include "string_nit.h"
 
 // Integer to NativeString method
@@ -18,3 +19,12 @@ char* native_int_to_s(long recv){
 	sprintf(str, "%ld", recv);
 	return str;
 }
+
+// Index of the first `c` between `from` (included) and `to` (excluded), -1 if none
+long native_index_of_char(char *recv, char c, long from, long to){
+	char *res;
+	if (to <= from) return -1;
+	res = memchr(recv + from, c, to - from);
+	if (res == NULL) return -1;
+	return res - recv;
+}
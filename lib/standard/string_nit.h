@@ -14,5 +14,6 @@
  */
 
 char* native_int_to_s(long recv);
+long native_index_of_char(char *recv, char c, long from, long to);
 
 #endif
@@ -0,0 +1,24 @@
+30
+25
+10
+0
+5
+26
+5
+18
+true
+5
+10
+30
+11
+113
+128
+32
+5
+1
+2
+3
+10
+(1,1) (2,2) (3,3)
+(5,5)
+(2,2) (1,1)
@@ -0,0 +1,18 @@
+-130 -130 true
+-129 -129 true
+-128 -128 true
+-1 -1 true
+0 0 true
+1 1 true
+1022 1022 true
+1023 1023 true
+1024 1024 true
+1025 1025 true
+97 90 10 0 200 
+true
+false
+true false  true
+true
+1
+3
+2
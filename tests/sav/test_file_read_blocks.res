@@ -0,0 +1,7 @@
+1314
+7
+true
+true
+true
+true
+true
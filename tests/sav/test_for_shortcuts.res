@@ -0,0 +1,11 @@
+1 3 4 
+1 2 3 4 5 
+a b c 
+X Y Z 
+3 4 5 
+one=1 two=2 three=3 
+l1 l2 
+1 2 3 4 5 
+d e f 
+x y z 
+
@@ -0,0 +1,34 @@
+GET /index.html HTTP/1.1 ?a=1&b=2
+  Cookie: x=1; y=2
+  Host: localhost
+  arg a=1
+  arg b=2
+x:1, y:2
+POST /form HTTP/1.1 ?
+  Content-Length: 11
+  Host: localhost
+  X-Folded: first second
+  arg name=a b
+  arg c=
+  body: name=a+b&c=
+GET / HTTP/1.0 ?
+HTTP error: request first line apprears invalid: INVALID
+true
+true
+400
+true
+411
+true
+501
+true 400
+true 400
+true 400
+true 400
+true 400
+true 400
+hello
+true
+431
+true
+true
+400
@@ -0,0 +1,14 @@
+true
+40
+true
+# This file is 
+part of NIT ( http://www.nitlanguage.org ).
+
+#
+
+true
+1052
+true
+true
+false
+true
@@ -0,0 +1,2 @@
+HTTP/1.1 200 OK
+true
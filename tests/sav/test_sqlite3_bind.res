@@ -0,0 +1,17 @@
+4
+4 named 0.0 with a note
+5 batch 5 1.5 -
+6 batch 6 1.5 -
+7 batch 7 1.5 -
+8 batch 8 1.5 -
+10000000000 item '1' 0.25 null
+20000000000 item '2' 0.5 null
+30000000000 item '3' 0.75 null
+7 batch 7
+8 batch 8
+10000000000 item '1'
+20000000000 item '2'
+30000000000 item '3'
+0
+1 full -
+2 null null
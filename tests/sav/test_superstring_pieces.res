@@ -0,0 +1,7 @@
+i=42 neg=-42 zero=0 c=x b=true not=false f=1.5
+42
+strstr
+x42true
+rope=strings a=123 o=A
+<42> <x> <str>
+big=1000000000000 min=-1000000000000